@@ -0,0 +1,18 @@
+#!/bin/sh
+# 包装qemu-system-riscv64，为xv6 Makefile启动的QEMU默认加上加速参数
+# 默认值来自环境变量QEMU_ACCEL（见Dockerfile），设为空则不附加-accel
+# 如果命令行里已经指定了加速方式，则原样传给QEMU
+QEMU=/usr/local/libexec/qemu-system-riscv64
+
+for arg in "$@"; do
+    case "$arg" in
+        -accel|--accel|-enable-kvm|--enable-kvm|*accel=*)
+            exec "$QEMU" "$@"
+            ;;
+    esac
+done
+
+if [ -z "$QEMU_ACCEL" ]; then
+    exec "$QEMU" "$@"
+fi
+exec "$QEMU" -accel "$QEMU_ACCEL" "$@"